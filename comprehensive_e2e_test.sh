@@ -8,6 +8,11 @@ echo "=================================================="
 echo "Date: $(date)"
 echo ""
 
+# Corpus location and worker count (override via environment)
+CORPUS_DIR="${CORPUS_DIR:-/Users/alice/dev/minz-ts}"
+CORPUS_DIR="${CORPUS_DIR%/}"
+JOBS="${JOBS:-$(getconf _NPROCESSORS_ONLN 2>/dev/null || echo 4)}"
+
 # Create test directories
 mkdir -p test_results/mza_output
 mkdir -p test_results/sjasmplus_output
@@ -53,7 +58,7 @@ echo "📋 Testing supertest_z80.a80 (comprehensive instruction set)..."
 
 # Test the supertest file first
 echo "=== SUPERTEST Z80 COMPREHENSIVE ===" >> "$mza_log"
-if ./mza /Users/alice/dev/minz-ts/supertest_z80.a80 -o test_results/mza_output/supertest.bin 2>&1 | tee -a "$mza_log" | grep -q "Assembly errors:"; then
+if ./mza "$CORPUS_DIR/supertest_z80.a80" -o test_results/mza_output/supertest.bin 2>&1 | tee -a "$mza_log" | grep -q "Assembly errors:"; then
     mza_supertest="❌ FAIL"
     echo "MZA SUPERTEST: FAILED" >> "$mza_log"
 else
@@ -62,7 +67,7 @@ else
 fi
 
 echo "=== SUPERTEST Z80 COMPREHENSIVE ===" >> "$sjasmplus_log"
-if sjasmplus /Users/alice/dev/minz-ts/supertest_z80.a80 --output=test_results/sjasmplus_output/supertest.bin 2>&1 | tee -a "$sjasmplus_log" | grep -q "Errors:"; then
+if sjasmplus "$CORPUS_DIR/supertest_z80.a80" --output=test_results/sjasmplus_output/supertest.bin 2>&1 | tee -a "$sjasmplus_log" | grep -q "Errors:"; then
     sjasmplus_supertest="❌ FAIL"
     echo "SjASMPlus SUPERTEST: FAILED" >> "$sjasmplus_log"
 else
@@ -76,54 +81,72 @@ echo "| Comprehensive | $mza_supertest | $sjasmplus_supertest | Full Z80 instruc
 echo ""
 echo "📊 Testing corpus of .a80 files..."
 
-# Test a representative sample of .a80 files (first 100 to avoid overwhelming output)
-find /Users/alice/dev/minz-ts -name "*.a80" -type f | head -100 | while read -r asm_file; do
-    total_files=$((total_files + 1))
-    filename=$(basename "$asm_file")
-    
-    # Progress indicator
-    if [ $((total_files % 10)) -eq 0 ]; then
-        echo "  Processed $total_files files..."
-    fi
-    
-    # Test with MZA
-    mza_result=false
-    if ./mza "$asm_file" -o "test_results/mza_output/${filename%.a80}.bin" 2>/dev/null; then
+# Assemble one file with both assemblers and print a CSV result line.
+# Each job runs in its own scratch directory, so side files (listings,
+# symbol dumps) from parallel runs cannot clobber each other.
+assemble_one() {
+    local asm_file=$1
+    # Key outputs and results on the path inside the corpus, so files with
+    # the same name in different directories don't collide
+    local filename=${asm_file#"$CORPUS_DIR"/}
+    case $asm_file in /*) ;; *) asm_file="$PWD/$asm_file" ;; esac
+    local scratch=$(mktemp -d)
+    local mza_result=false
+    local sjasmplus_result=false
+
+    mkdir -p "$RESULTS_DIR/mza_output/$(dirname "$filename")" \
+             "$RESULTS_DIR/sjasmplus_output/$(dirname "$filename")"
+    if (cd "$scratch" && "$MZA" "$asm_file" -o "$RESULTS_DIR/mza_output/${filename%.a80}.bin") >/dev/null 2>&1; then
         mza_result=true
-        mza_success=$((mza_success + 1))
     fi
-    
-    # Test with SjASMPlus  
-    sjasmplus_result=false
-    if sjasmplus "$asm_file" --output="test_results/sjasmplus_output/${filename%.a80}.bin" 2>/dev/null; then
+    if (cd "$scratch" && sjasmplus "$asm_file" --output="$RESULTS_DIR/sjasmplus_output/${filename%.a80}.bin") >/dev/null 2>&1; then
         sjasmplus_result=true
-        sjasmplus_success=$((sjasmplus_success + 1))
     fi
-    
-    # Track compatibility patterns
-    if $mza_result && $sjasmplus_result; then
+    rm -rf "$scratch"
+    # The path goes last so a comma in it cannot shift the other columns
+    echo "$mza_result,$sjasmplus_result,$filename"
+}
+export -f assemble_one
+export MZA="$(pwd)/mza"
+export CORPUS_DIR
+export RESULTS_DIR="$(pwd)/test_results"
+
+# Test a representative sample of .a80 files (first 100 to avoid overwhelming output)
+results_csv="test_results/reports/results.csv"
+echo "  Running on $JOBS workers..."
+echo "mza,sjasmplus,file" > "$results_csv"
+find "$CORPUS_DIR" -name "*.a80" -type f | head -100 | tr '\n' '\0' | \
+    xargs -0 -P "$JOBS" -n 1 bash -c 'assemble_one "$0"' | sort -t, -k3 >> "$results_csv"
+
+# Tally compatibility patterns
+rm -f test_results/reports/both_success.txt test_results/reports/mza_only.txt \
+      test_results/reports/sjasmplus_only.txt test_results/reports/both_fail.txt
+while IFS=, read -r mza_result sjasmplus_result filename; do
+    total_files=$((total_files + 1))
+    [ "$mza_result" = true ] && mza_success=$((mza_success + 1))
+    [ "$sjasmplus_result" = true ] && sjasmplus_success=$((sjasmplus_success + 1))
+
+    if [ "$mza_result" = true ] && [ "$sjasmplus_result" = true ]; then
         both_success=$((both_success + 1))
         echo "✅✅ $filename" >> test_results/reports/both_success.txt
-    elif $mza_result && ! $sjasmplus_result; then
+    elif [ "$mza_result" = true ]; then
         mza_only=$((mza_only + 1))
         echo "✅❌ $filename" >> test_results/reports/mza_only.txt
-    elif ! $mza_result && $sjasmplus_result; then
+    elif [ "$sjasmplus_result" = true ]; then
         sjasmplus_only=$((sjasmplus_only + 1))
         echo "❌✅ $filename" >> test_results/reports/sjasmplus_only.txt
     else
         both_fail=$((both_fail + 1))
         echo "❌❌ $filename" >> test_results/reports/both_fail.txt
     fi
-    
-    # Log detailed results every 10 files
-    if [ $((total_files % 10)) -eq 0 ]; then
-        echo "=== BATCH $total_files SUMMARY ===" >> "$mza_log"
-        echo "MZA Success Rate: $((mza_success * 100 / total_files))%" >> "$mza_log"
-        echo "SjASMPlus Success Rate: $((sjasmplus_success * 100 / total_files))%" >> "$sjasmplus_log"
-        echo "" >> "$mza_log"
-        echo "" >> "$sjasmplus_log"
-    fi
-done
+done < <(tail -n +2 "$results_csv")
+
+echo "=== CORPUS SUMMARY ($total_files files) ===" >> "$mza_log"
+echo "=== CORPUS SUMMARY ($total_files files) ===" >> "$sjasmplus_log"
+if [ $total_files -gt 0 ]; then
+    echo "MZA Success Rate: $((mza_success * 100 / total_files))%" >> "$mza_log"
+    echo "SjASMPlus Success Rate: $((sjasmplus_success * 100 / total_files))%" >> "$sjasmplus_log"
+fi
 
 # Calculate final statistics
 if [ $total_files -gt 0 ]; then
@@ -202,6 +225,7 @@ echo "📁 Test Results Available:"
 echo "  📊 Compatibility Report: $compatibility_report"
 echo "  📋 MZA Detailed Log: $mza_log"
 echo "  📋 SjASMPlus Detailed Log: $sjasmplus_log"
+echo "  📋 Per-file Results (CSV): $results_csv"
 echo "  📁 Binary Outputs: test_results/mza_output/ and test_results/sjasmplus_output/"
 
 echo ""
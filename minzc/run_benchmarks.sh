@@ -0,0 +1,226 @@
+#!/bin/bash
+# Cycle/size regression benchmarks for MinZ
+# Compiles tests/benchmarks/*.minz for every backend, measures the output and
+# compares it against tests/benchmarks/baseline.csv.
+#
+# Usage: ./run_benchmarks.sh [--targets=z80,c,...] [--update-baseline]
+#                            [--require-baseline]
+#
+# Metrics per (benchmark, target):
+#   bytes  - assembled Z80 binary size (needs ./mza)
+#   instrs - instruction lines in the generated assembly/IR
+#   ms     - wall time of the natively built C program (needs cc)
+# Size metrics fail above THRESHOLD percent growth, wall time above
+# TIME_THRESHOLD percent (it is noisy). The C program's output must match
+# tests/benchmarks/<name>.expected, and a baseline metric that disappears
+# from the results counts as a regression. --require-baseline (for CI)
+# fails when there is no baseline to compare against.
+
+# Colors for output
+RED='\033[0;31m'
+GREEN='\033[0;32m'
+YELLOW='\033[1;33m'
+BLUE='\033[0;34m'
+NC='\033[0m' # No Color
+
+# Configuration
+MZ="./mz"
+MZA="./mza"
+CC="${CC:-cc}"
+BENCH_DIR="tests/benchmarks"
+OUTPUT_DIR="test_outputs/benchmarks"
+BASELINE="$BENCH_DIR/baseline.csv"
+RESULTS="$OUTPUT_DIR/results.csv"
+THRESHOLD="${THRESHOLD:-2}"
+TIME_THRESHOLD="${TIME_THRESHOLD:-25}"
+ALL_TARGETS="z80,6502,68000,i8080,gb,c,llvm,wasm"
+TARGETS="$ALL_TARGETS"
+UPDATE_BASELINE=false
+REQUIRE_BASELINE=false
+
+for arg in "$@"; do
+    case $arg in
+        --targets=*) TARGETS="${arg#--targets=}" ;;
+        --update-baseline) UPDATE_BASELINE=true ;;
+        --require-baseline) REQUIRE_BASELINE=true ;;
+        *) echo "Unknown option: $arg"; exit 2 ;;
+    esac
+done
+
+# Split the target list, dropping empty entries and duplicates
+BACKENDS=()
+IFS=',' read -r -a REQUESTED <<< "$TARGETS"
+for backend in "${REQUESTED[@]}"; do
+    backend="${backend// /}"
+    [ -z "$backend" ] && continue
+    [[ " ${BACKENDS[*]} " == *" $backend "* ]] && continue
+    BACKENDS+=("$backend")
+done
+if [ ${#BACKENDS[@]} -eq 0 ]; then
+    echo -e "${RED}✗ No backends selected (--targets from: $ALL_TARGETS)${NC}"
+    exit 2
+fi
+
+mkdir -p "$OUTPUT_DIR"
+
+# Output extension per backend (same as test_backend_e2e.sh)
+ext_for() {
+    case $1 in
+        z80) echo "a80" ;;
+        6502|68000) echo "s" ;;
+        i8080) echo "asm" ;;
+        gb) echo "gb.s" ;;
+        c) echo "c" ;;
+        llvm) echo "ll" ;;
+        wasm) echo "wat" ;;
+    esac
+}
+
+# Count instruction lines: skip blanks, comments, labels and directives
+count_instrs() {
+    local file=$1
+    case $file in
+        *.c)   grep -cE '^[[:space:]]+[^[:space:]/].*;[[:space:]]*$' "$file" ;;
+        *.ll)  grep -cE '^[[:space:]]+[%a-z]' "$file" ;;
+        *.wat) grep -cE '^[[:space:]]+[a-z][a-z0-9]*\.[a-z]|^[[:space:]]+(call|br|br_if|return|local\.[gst]et)' "$file" ;;
+        *)     grep -vE '^[[:space:]]*($|[;|*])|:[[:space:]]*(;.*)?$|^[[:space:]]*\.|[[:space:]](ORG|EQU|DB|DW|DS|org|equ)[[:space:]]' "$file" | grep -c . ;;
+    esac
+}
+
+# Wall time of a command in milliseconds (bash builtin timer);
+# the command's stdout goes to the file given as the first argument
+time_ms() {
+    local TIMEFORMAT=%R
+    local stdout=$1 secs
+    shift
+    secs=$( { time "$@" >"$stdout" 2>/dev/null; } 2>&1 )
+    awk -v s="$secs" 'BEGIN { printf "%d\n", s * 1000 }'
+}
+
+echo -e "${BLUE}=== MinZ Benchmark Suite ===${NC}"
+echo "benchmark,target,metric,value" > "$RESULTS"
+
+for src in "$BENCH_DIR"/*.minz; do
+    name=$(basename "$src" .minz)
+    echo -e "${YELLOW}$name${NC}"
+    for backend in "${BACKENDS[@]}"; do
+        out="$OUTPUT_DIR/${name}_$backend.$(ext_for "$backend")"
+        if ! $MZ "$src" -b "$backend" -o "$out" >/dev/null 2>&1; then
+            echo -e "  ${RED}✗ $backend: compilation failed${NC}"
+            echo "$name,$backend,compile,failed" >> "$RESULTS"
+            continue
+        fi
+        instrs=$(count_instrs "$out")
+        echo "$name,$backend,instrs,$instrs" >> "$RESULTS"
+        line="instrs=$instrs"
+
+        if [ "$backend" = "z80" ] && [ -x "$MZA" ]; then
+            if $MZA "$out" -o "${out%.a80}.bin" >/dev/null 2>&1; then
+                bytes=$(wc -c < "${out%.a80}.bin" | tr -d ' ')
+                echo "$name,$backend,bytes,$bytes" >> "$RESULTS"
+                line="$line bytes=$bytes"
+            fi
+        fi
+
+        if [ "$backend" = "c" ] && $CC -O2 "$out" -o "${out%.c}" >/dev/null 2>&1; then
+            ms=$(time_ms "${out%.c}.out" "${out%.c}")
+            expected="$BENCH_DIR/$name.expected"
+            # A miscompile that runs faster is not an improvement
+            if [ -f "$expected" ] && ! cmp -s "$expected" "${out%.c}.out"; then
+                echo -e "  ${RED}✗ $backend: wrong output (see ${out%.c}.out)${NC}"
+                echo "$name,$backend,output,wrong" >> "$RESULTS"
+            else
+                echo "$name,$backend,ms,$ms" >> "$RESULTS"
+                line="$line ms=$ms"
+            fi
+        fi
+        echo "  $backend: $line"
+    done
+done
+
+# Compile failures and wrong output fail with or without a baseline
+FAILED=$(grep -c ',compile,failed$' "$RESULTS")
+WRONG=$(grep -c ',output,wrong$' "$RESULTS")
+
+if $UPDATE_BASELINE; then
+    if [ "$FAILED" -gt 0 ] || [ "$WRONG" -gt 0 ]; then
+        echo -e "${RED}✗ $FAILED compile failure(s), $WRONG wrong output(s) - baseline not updated${NC}"
+        exit 1
+    fi
+    cp "$RESULTS" "$BASELINE"
+    echo -e "${GREEN}✓ Baseline updated: $BASELINE${NC}"
+    exit 0
+fi
+
+if [ ! -f "$BASELINE" ]; then
+    if $REQUIRE_BASELINE; then
+        echo -e "${RED}✗ No baseline at $BASELINE - run with --update-baseline first${NC}"
+        exit 1
+    fi
+    echo -e "${YELLOW}⚠️  No baseline at $BASELINE - run with --update-baseline first${NC}"
+    if [ "$FAILED" -gt 0 ] || [ "$WRONG" -gt 0 ]; then
+        echo -e "${RED}✗ $FAILED compile failure(s), $WRONG wrong output(s)${NC}"
+        exit 1
+    fi
+    exit 0
+fi
+
+# Compare against the baseline
+echo
+echo -e "${BLUE}=== Regression Check (size +${THRESHOLD}%, time +${TIME_THRESHOLD}%) ===${NC}"
+REGRESSIONS=$((FAILED + WRONG))
+
+# Baseline metrics that are gone from the results
+while IFS=, read -r name backend metric old; do
+    [ "$metric" = "compile" ] && continue
+    grep -q "^$name,$backend,$metric," "$RESULTS" && continue
+    if grep -q "^$name,$backend,compile,failed$" "$RESULTS"; then
+        # Already counted in FAILED; report it once, not once per lost metric
+        [ "$metric" = "instrs" ] && echo -e "${RED}✗ $name/$backend now fails to compile${NC}"
+        continue
+    fi
+    # Already counted in WRONG
+    grep -q "^$name,$backend,output,wrong$" "$RESULTS" && continue
+    echo -e "${RED}✗ $name/$backend $metric: $old → missing${NC}"
+    REGRESSIONS=$((REGRESSIONS + 1))
+done < <(tail -n +2 "$BASELINE")
+
+# Metrics present in both
+while IFS=, read -r name backend metric value; do
+    case $metric in
+        compile|output) continue ;;
+    esac
+    old=$(awk -F, -v n="$name" -v b="$backend" -v m="$metric" \
+        '$1 == n && $2 == b && $3 == m { print $4 }' "$BASELINE")
+    if [ -z "$old" ]; then
+        echo -e "${YELLOW}⚠️  $name/$backend $metric: $value (not in baseline)${NC}"
+        continue
+    fi
+    # A duplicated or corrupt row must not make the comparison vacuous
+    if ! [[ $old =~ ^[0-9]+$ && $value =~ ^[0-9]+$ ]]; then
+        echo -e "${RED}✗ $name/$backend $metric: cannot compare '${old//$'\n'/|}' with '$value'${NC}"
+        REGRESSIONS=$((REGRESSIONS + 1))
+        continue
+    fi
+    limit=$THRESHOLD
+    if [ "$metric" = "ms" ]; then
+        # Runs under 10 ms are timer noise
+        [ "$old" -lt 10 ] && continue
+        limit=$TIME_THRESHOLD
+    fi
+    if [ "$value" -gt $(( old + old * limit / 100 )) ]; then
+        echo -e "${RED}✗ $name/$backend $metric: $old → $value${NC}"
+        REGRESSIONS=$((REGRESSIONS + 1))
+    elif [ "$value" -lt "$old" ]; then
+        echo -e "${GREEN}✓ $name/$backend $metric: $old → $value${NC}"
+    fi
+done < <(tail -n +2 "$RESULTS")
+
+echo
+if [ $REGRESSIONS -eq 0 ]; then
+    echo -e "${GREEN}✓ No regressions against baseline${NC}"
+    exit 0
+else
+    echo -e "${RED}✗ $REGRESSIONS regression(s) against baseline${NC}"
+    exit 1
+fi
@@ -17,6 +17,32 @@ TEST_DIR="tests/minz"
 OUTPUT_DIR="test_outputs"
 BINARY_DIR="$OUTPUT_DIR/binaries"
 
+ALL_TARGETS="z80,6502,68000,i8080,gb,c,llvm,wasm"
+TARGETS="$ALL_TARGETS"
+
+# Usage: ./test_backend_e2e.sh [--targets=z80,c,...]
+# Backends run concurrently; their logs are printed in the order given.
+for arg in "$@"; do
+    case $arg in
+        --targets=*) TARGETS="${arg#--targets=}" ;;
+        *) echo "Unknown option: $arg"; exit 2 ;;
+    esac
+done
+
+# Split the target list, dropping empty entries and duplicates
+BACKENDS=()
+IFS=',' read -r -a REQUESTED <<< "$TARGETS"
+for backend in "${REQUESTED[@]}"; do
+    backend="${backend// /}"
+    [ -z "$backend" ] && continue
+    [[ " ${BACKENDS[*]} " == *" $backend "* ]] && continue
+    BACKENDS+=("$backend")
+done
+if [ ${#BACKENDS[@]} -eq 0 ]; then
+    echo -e "${RED}✗ No backends selected (--targets from: $ALL_TARGETS)${NC}"
+    exit 2
+fi
+
 # Ensure directories exist
 mkdir -p "$BINARY_DIR"
 
@@ -38,21 +64,16 @@ echo -e "${BLUE}=== MinZ E2E Backend Testing ===${NC}"
 echo "Testing compilation from MinZ → AST → MIR → Backend → Binary"
 echo
 
-# Track results
-RESULTS=""
-TOTAL=0
-PASSED=0
-FAILED_BACKENDS=""
-
-# Function to test a backend
+# Function to test a backend; writes its result to $OUTPUT_DIR/<backend>/e2e_test.status
 test_backend() {
     local backend=$1
     local output_ext=$2
     local compile_cmd=$3
     local run_cmd=$4
     local expected_output=$5
+    local status_file="$OUTPUT_DIR/$backend/e2e_test.status"
     
-    TOTAL=$((TOTAL + 1))
+    mkdir -p "$OUTPUT_DIR/$backend"
     echo -e "${YELLOW}Testing $backend backend...${NC}"
     
     # Step 1: Compile MinZ to backend format
@@ -61,7 +82,7 @@ test_backend() {
         echo -e "     ${GREEN}✓ Generated $output_ext${NC}"
     else
         echo -e "     ${RED}✗ Failed to generate $output_ext${NC}"
-        RESULTS[$backend]="FAILED (compilation)"
+        echo "FAILED (compilation)" > "$status_file"
         return
     fi
     
@@ -72,7 +93,7 @@ test_backend() {
             echo -e "     ${GREEN}✓ Generated binary${NC}"
         else
             echo -e "     ${RED}✗ Failed to generate binary${NC}"
-            RESULTS[$backend]="FAILED (binary generation)"
+            echo "FAILED (binary generation)" > "$status_file"
             return
         fi
     fi
@@ -83,53 +104,72 @@ test_backend() {
         actual_output=$(eval "$run_cmd" 2>&1 || echo "EXECUTION_FAILED")
         if [ "$actual_output" = "$expected_output" ]; then
             echo -e "     ${GREEN}✓ Output correct: $actual_output${NC}"
-            RESULTS[$backend]="PASSED"
-            PASSED=$((PASSED + 1))
+            echo "PASSED" > "$status_file"
         else
             echo -e "     ${RED}✗ Output incorrect: got '$actual_output', expected '$expected_output'${NC}"
-            RESULTS[$backend]="FAILED (wrong output)"
+            echo "FAILED (wrong output)" > "$status_file"
         fi
     else
         # For backends we can't run directly
-        RESULTS[$backend]="GENERATED"
-        PASSED=$((PASSED + 1))
+        echo "GENERATED" > "$status_file"
     fi
-    
-    echo
 }
 
-# Test Z80 backend
-test_backend "z80" "a80" "" "" ""
-
-# Test 6502 backend
-test_backend "6502" "s" "" "" ""
-
-# Test 68000 backend
-test_backend "68000" "s" "" "" ""
-
-# Test i8080 backend
-test_backend "i8080" "asm" "" "" ""
-
-# Test Game Boy backend
-test_backend "gb" "gb.s" "" "" ""
-
-# Test C backend
-test_backend "c" "c" \
-    "clang -O2 $OUTPUT_DIR/c/e2e_test.c -o $BINARY_DIR/e2e_test_c 2>/dev/null" \
-    "" \
-    ""
+# Start one backend test in the background, logging to $OUTPUT_DIR/<backend>/e2e_test.log
+run_backend() {
+    local backend=$1
+    mkdir -p "$OUTPUT_DIR/$backend"
+    rm -f "$OUTPUT_DIR/$backend/e2e_test.status"
+    case $backend in
+        z80)   test_backend "z80" "a80" "" "" "" ;;
+        6502)  test_backend "6502" "s" "" "" "" ;;
+        68000) test_backend "68000" "s" "" "" "" ;;
+        i8080) test_backend "i8080" "asm" "" "" "" ;;
+        gb)    test_backend "gb" "gb.s" "" "" "" ;;
+        c)
+            test_backend "c" "c" \
+                "clang -O2 $OUTPUT_DIR/c/e2e_test.c -o $BINARY_DIR/e2e_test_c 2>/dev/null" \
+                "" \
+                ""
+            ;;
+        llvm)
+            test_backend "llvm" "ll" \
+                "clang $OUTPUT_DIR/llvm/e2e_test.ll -o $BINARY_DIR/e2e_test_llvm 2>/dev/null || echo 'LLVM compilation failed (expected - missing variable names)'" \
+                "" \
+                ""
+            ;;
+        wasm)
+            test_backend "wasm" "wat" \
+                "command -v wat2wasm >/dev/null && wat2wasm $OUTPUT_DIR/wasm/e2e_test.wat -o $BINARY_DIR/e2e_test.wasm" \
+                "" \
+                ""
+            ;;
+        *)
+            echo -e "${RED}✗ Unknown backend: $backend${NC}"
+            echo "FAILED (unknown backend)" > "$OUTPUT_DIR/$backend/e2e_test.status"
+            ;;
+    esac > "$OUTPUT_DIR/$backend/e2e_test.log" 2>&1 &
+}
 
-# Test LLVM backend
-test_backend "llvm" "ll" \
-    "clang $OUTPUT_DIR/llvm/e2e_test.ll -o $BINARY_DIR/e2e_test_llvm 2>/dev/null || echo 'LLVM compilation failed (expected - missing variable names)'" \
-    "" \
-    ""
+for backend in "${BACKENDS[@]}"; do
+    run_backend "$backend"
+done
+wait
 
-# Test WebAssembly backend
-test_backend "wasm" "wat" \
-    "command -v wat2wasm >/dev/null && wat2wasm $OUTPUT_DIR/wasm/e2e_test.wat -o $BINARY_DIR/e2e_test.wasm" \
-    "" \
-    ""
+# Collect results in the requested order
+RESULTS=""
+TOTAL=0
+PASSED=0
+for backend in "${BACKENDS[@]}"; do
+    cat "$OUTPUT_DIR/$backend/e2e_test.log"
+    echo
+    status=$(cat "$OUTPUT_DIR/$backend/e2e_test.status" 2>/dev/null || echo "FAILED (no result)")
+    TOTAL=$((TOTAL + 1))
+    if [ "$status" = "PASSED" ] || [ "$status" = "GENERATED" ]; then
+        PASSED=$((PASSED + 1))
+    fi
+    RESULTS="$RESULTS$backend: $status\n"
+done
 
 # Summary
 echo -e "${BLUE}=== Test Summary ===${NC}"
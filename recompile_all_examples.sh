@@ -9,10 +9,91 @@ mkdir -p examples/output
 # Change to compiler directory
 cd minzc
 
+# Outputs are cached: each example's .key file holds a hash of the compiler
+# binary, the flags, the source and every module it imports (transitively).
+# An example importing a module that cannot be found is never cached.
+# Set MINZ_NO_CACHE=1 to force a full rebuild.
+MZ_FLAGS=""
+CACHE_DIR="../examples/output/.cache"
+mkdir -p "$CACHE_DIR"
+
+hash_stdin() {
+    if command -v sha256sum >/dev/null 2>&1; then
+        sha256sum | cut -d' ' -f1
+    else
+        shasum -a 256 | cut -d' ' -f1
+    fi
+}
+
+# Resolve a dotted module name to its source file, if there is one.
+# Same order as the compiler: stdlib/, the importing file's directory,
+# then each entry of MINZ_PATH.
+module_path() {
+    local dir=$1 mod=$2
+    local base search_path
+    IFS=':' read -r -a search_path <<< "$MINZ_PATH"
+    for base in ../stdlib "$dir" "${search_path[@]}"; do
+        [ -n "$base" ] || continue
+        if [ -f "$base/${mod//.//}.minz" ]; then
+            echo "$base/${mod//.//}.minz"
+            return
+        fi
+    done
+}
+
+# Print the source path of every module imported by $1, transitively.
+# Handles `import a.b;` and `use a.b.symbol;` / `use a.b.{x, y};`, where
+# the trailing symbol is dropped unless it names a module file itself.
+# Built-in modules (std, zx.*) have no source; any other module that
+# cannot be resolved is printed as "?".
+module_deps() {
+    local file=$1
+    local dir=$(dirname "$file")
+    local mod path
+    for mod in $(sed -nE 's/^[[:space:]]*(import|use)[[:space:]]+([A-Za-z0-9_.]+).*/\2/p' "$file"); do
+        mod=${mod%.}
+        case $mod in
+            std|std.*|zx|zx.*) continue ;;
+        esac
+        path=$(module_path "$dir" "$mod")
+        if [ -z "$path" ] && [[ "$mod" == *.* ]]; then
+            path=$(module_path "$dir" "${mod%.*}")
+        fi
+        if [ -z "$path" ]; then
+            echo "?"
+            continue
+        fi
+        if [[ " $seen_deps " != *" $path "* ]]; then
+            seen_deps="$seen_deps $path"
+            echo "$path"
+            module_deps "$path"
+        fi
+    done
+}
+
+# Print the cache key for $1, or fail if one of its imports is unresolved
+cache_key() {
+    local file=$1 deps
+    seen_deps=""
+    deps=$(module_deps "$file" | sort -u)
+    grep -qx '?' <<< "$deps" && return 1
+    {
+        echo "$COMPILER_HASH $MZ_FLAGS"
+        cat "$file"
+        for dep in $deps; do
+            echo "== $dep"
+            cat "$dep"
+        done
+    } | hash_stdin
+}
+
+COMPILER_HASH=$(hash_stdin < ./minzc)
+
 # Counter for statistics
 total=0
 successful=0
 failed=0
+cached=0
 
 # Compile each .minz file in examples/
 for file in ../examples/*.minz; do
@@ -20,14 +101,30 @@ for file in ../examples/*.minz; do
         basename=$(basename "$file" .minz)
         echo "Compiling $basename..."
         total=$((total + 1))
+        output="../examples/output/$basename.a80"
+        key_file="$CACHE_DIR/$basename.key"
+        key=$(cache_key "$file") || key=""
+        
+        if [ -z "$MINZ_NO_CACHE" ] && [ -n "$key" ] && [ -f "$output" ] && [ "$(cat "$key_file" 2>/dev/null)" = "$key" ]; then
+            echo "✅ $basename up to date (cached)"
+            successful=$((successful + 1))
+            cached=$((cached + 1))
+            continue
+        fi
         
         # Compile with output to examples/output/
-        if ./minzc "$file" -o "../examples/output/$basename.a80" 2>/dev/null; then
+        if ./minzc "$file" $MZ_FLAGS -o "$output" 2>/dev/null; then
             echo "✅ $basename compiled successfully"
             successful=$((successful + 1))
+            if [ -n "$key" ]; then
+                echo "$key" > "$key_file"
+            else
+                rm -f "$key_file"
+            fi
         else
             echo "❌ $basename compilation failed"
             failed=$((failed + 1))
+            rm -f "$key_file"
         fi
     fi
 done
@@ -35,7 +132,7 @@ done
 echo ""
 echo "📊 Compilation Summary:"
 echo "   Total files: $total"
-echo "   Successful: $successful"
+echo "   Successful: $successful ($cached from cache)"
 echo "   Failed: $failed"
 
 if [ $failed -eq 0 ]; then